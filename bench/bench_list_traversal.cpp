@@ -0,0 +1,120 @@
+#include <iostream>
+#include "../include/list.h"
+#include <memory_resource>
+#include <new>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+// Ресурс с free-list поверх одного большого буфера. Слоты отдаются в порядке
+// освобождения, а начальный free-list перемешан — так выглядит пул после долгого
+// переиспользования: соседние узлы списка оказываются в случайных местах памяти
+class ShuffledSlotResource : public std::pmr::memory_resource {
+    std::size_t slot_size;
+    std::vector<std::byte> arena;
+    std::vector<void*> free_slots;
+
+public:
+    ShuffledSlotResource(std::size_t slots, std::size_t slot_bytes)
+        : slot_size((slot_bytes + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t)),
+          arena(slots * slot_size + alignof(std::max_align_t)) {
+        auto base = reinterpret_cast<std::uintptr_t>(arena.data());
+        base = (base + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+        for (std::size_t i = 0; i < slots; ++i) {
+            free_slots.push_back(reinterpret_cast<void*>(base + i * slot_size));
+        }
+        std::shuffle(free_slots.begin(), free_slots.end(), std::mt19937_64{42});
+    }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        if (bytes > slot_size || alignment > alignof(std::max_align_t) || free_slots.empty()) {
+            throw std::bad_alloc();
+        }
+        void* p = free_slots.back();
+        free_slots.pop_back();
+        return p;
+    }
+
+    void do_deallocate(void* ptr, std::size_t, std::size_t) override {
+        free_slots.push_back(ptr);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Раскладка совпадает с list<std::uint64_t>::Node: данные + prev + next
+struct NodeLayout {
+    std::uint64_t data;
+    void* prev;
+    void* next;
+};
+
+// Имитация полезной работы над элементом: цепочка зависимых умножений
+static std::uint64_t work(std::uint64_t v) {
+    for (int i = 0; i < 64; ++i) {
+        v = v * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    return v;
+}
+
+template <typename F>
+static double measure_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+int main(int argc, char** argv) {
+    const std::size_t count = (argc > 1) ? std::stoull(argv[1]) : (std::size_t{1} << 21);
+    const int rounds = 5;
+
+    ShuffledSlotResource mr(count, sizeof(NodeLayout));
+
+    list<std::uint64_t> values(&mr);
+    for (std::size_t i = 0; i < count; ++i) {
+        values.push_back(i);
+    }
+
+    std::uint64_t sink = 0;
+    auto run = [&](const char* title, auto&& process) {
+        double plain = 1e300, prefetched = 1e300, batched = 1e300;
+        for (int r = 0; r < rounds; ++r) {
+            plain = std::min(plain, measure_ms([&] {
+                for (auto it = values.begin(); it != values.end(); ++it) {
+                    sink += process(*it);
+                }
+            }));
+            prefetched = std::min(prefetched, measure_ms([&] {
+                for (auto it = values.prefetch_begin(); it != values.prefetch_end(); ++it) {
+                    sink += process(*it);
+                }
+            }));
+            batched = std::min(batched, measure_ms([&] {
+                values.for_each_batch([&](std::span<std::uint64_t* const> batch) {
+                    for (std::uint64_t* v : batch) {
+                        sink += process(*v);
+                    }
+                }, 64);
+            }));
+        }
+        std::cout << "\n--- " << title << " ---\n";
+        std::cout << "iterator:          " << plain << " ms\n";
+        std::cout << "prefetch_iterator: " << prefetched << " ms (x" << plain / prefetched << ")\n";
+        std::cout << "for_each_batch:    " << batched << " ms (x" << plain / batched << ")\n";
+    };
+
+    std::cout << "Nodes: " << count << " (shuffled), best of " << rounds << " rounds\n";
+    run("sum only", [](std::uint64_t v) { return v; });
+    run("sum + work per element", [](std::uint64_t v) { return work(v); });
+    std::cout << "checksum: " << sink << std::endl;
+    return 0;
+}
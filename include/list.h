@@ -8,6 +8,9 @@
 #include <cstddef>
 #include <stdexcept>
 #include <iostream>
+#include <algorithm>
+#include <span>
+#include <vector>
 
 template <typename T>
 class list {
@@ -25,6 +28,15 @@ class list {
         size_t list_size; // Количество элементов в списке
         std::pmr::polymorphic_allocator<Node> allocator; // Аллокатор для узлов
 
+        // Подсказка процессору заранее загрузить узел в кэш
+        static void prefetch(const Node* node) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(node);
+#else
+            (void)node;
+#endif
+        }
+
     public:
         class iterator {
             private:
@@ -60,6 +72,48 @@ class list {
                     return current != other.current;
                 }
         };
+
+        // Итератор с программной предвыборкой: при переходе на узел сразу запрашивает
+        // следующий, и его загрузка идёт параллельно с обработкой текущего элемента.
+        // Опережение — ровно один узел: адрес узла через два шага известен только после
+        // загрузки следующего, поэтому заглянуть по цепочке next дальше нельзя
+        class prefetch_iterator {
+            private:
+                Node* current;
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = T*;
+                using reference = T&;
+                explicit prefetch_iterator(Node* node) : current(node) {
+                    if (current) prefetch(current->next);
+                }
+
+                reference operator*() { return current->data; }
+                pointer operator->() { return &(current->data); }
+
+                prefetch_iterator& operator++() {
+                    current = current->next;
+                    if (current) prefetch(current->next);
+                    return *this;
+                }
+
+                prefetch_iterator operator++(int) {
+                    prefetch_iterator temp = *this;
+                    ++(*this);
+                    return temp;
+                }
+
+                bool operator==(const prefetch_iterator& other) const {
+                    return current == other.current;
+                }
+
+                bool operator!=(const prefetch_iterator& other) const {
+                    return current != other.current;
+                }
+        };
         list(std::pmr::memory_resource* mr) : allocator(mr),
                                                             head(nullptr), 
                                                             tail(nullptr), 
@@ -158,4 +212,30 @@ class list {
         };
         iterator begin() { return iterator(head);}
         iterator end() { return iterator(nullptr); }
+        prefetch_iterator prefetch_begin() { return prefetch_iterator(head); }
+        prefetch_iterator prefetch_end() { return prefetch_iterator(nullptr); }
+
+        // Обход списка пачками: callback получает std::span<T* const> длиной не более
+        // batch_size (последняя пачка может быть короче). Узлы читаются через prefetch_iterator.
+        // Буфер пачки берётся из обычной кучи, а не из ресурса узлов: обход только читает
+        // список и не должен отнимать место у узлов в заполненном пуле
+        template <typename Callback>
+        void for_each_batch(Callback&& callback, std::size_t batch_size) {
+            if (batch_size == 0) {
+                throw std::invalid_argument("Batch size must be positive");
+            }
+
+            std::vector<T*> batch;
+            batch.reserve(std::min(batch_size, list_size));
+            for (auto it = prefetch_begin(); it != prefetch_end(); ++it) {
+                batch.push_back(&*it);
+                if (batch.size() == batch_size) {
+                    callback(std::span<T* const>(batch));
+                    batch.clear();
+                }
+            }
+            if (!batch.empty()) {
+                callback(std::span<T* const>(batch));
+            }
+        }
 };
\ No newline at end of file
@@ -9,6 +9,12 @@
 #include <exception>
 #include <algorithm>
 #include <list>
+#include <map>
+#include <utility>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
 #include <new>
 #include <stdexcept>
 #include <cstddef>
@@ -21,15 +27,28 @@ class CustomMemoryResource : public std::pmr::memory_resource {
         std::size_t alignment{alignof(std::max_align_t)};
     };
 
-    // Списки блоков: занятые и свободные для повторного использования
+    // Ключ корзины свободных блоков: (размер, выравнивание)
+    using BlockKey = std::pair<std::size_t, std::size_t>;
+
+    // Списки блоков: занятые и свободные для повторного использования.
+    // Свободные разложены по корзинам, чтобы поиск не проходил по блокам других размеров
     std::list<MemoryBlock> used_blocks;
-    std::list<MemoryBlock> free_blocks;
+    std::map<BlockKey, std::list<MemoryBlock>> free_blocks;
 
     std::size_t capacity_{0};            // общий размер пула (контракт тестов)
     std::size_t used_memory_{0};         // байт в данный момент занято
     bool verbose_{false};                 // флаг логирования
 
 public:
+    // Строка профиля прогрева: count блоков размера size с выравниванием alignment
+    struct ProfileEntry {
+        std::size_t size{0};
+        std::size_t alignment{alignof(std::max_align_t)};
+        std::size_t count{0};
+
+        bool operator==(const ProfileEntry&) const = default;
+    };
+
     explicit CustomMemoryResource(std::size_t capacity = 0, bool verbose = false) noexcept
         : capacity_(capacity), used_memory_(0), verbose_(verbose) {}
 
@@ -42,10 +61,8 @@ public:
                 ::operator delete(b.ptr, std::align_val_t(b.alignment));
             }
         }
-        for (auto &b : free_blocks) {
-            if (b.ptr) {
-                ::operator delete(b.ptr, std::align_val_t(b.alignment));
-            }
+        for (auto &[key, bucket] : free_blocks) {
+            release(bucket);
         }
     }
 
@@ -53,19 +70,154 @@ public:
     std::size_t get_used_memory() const noexcept { return used_memory_; }
     std::size_t get_free_memory() const noexcept { return (capacity_ > used_memory_) ? (capacity_ - used_memory_) : 0; }
 
+    // Прогрев: заранее выделяем блоки по профилю и кладём их в free-list,
+    // чтобы первые выделения после старта не шли на кучу. Профиль проверяется целиком
+    // до выделения; при ошибке состояние ресурса не меняется. При ненулевой ёмкости
+    // профиль вместе с уже удерживаемыми блоками (занятыми и свободными) не должен её превышать
+    void warm_up(const std::vector<ProfileEntry>& profile) {
+        std::size_t total = 0;
+        for (const auto& entry : profile) {
+            if (!is_valid(entry)) {
+                throw std::invalid_argument("Некорректная запись профиля");
+            }
+            if (entry.count != 0 && entry.size > (SIZE_MAX - total) / entry.count) {
+                throw std::invalid_argument("Профиль превышает ёмкость пула");
+            }
+            total += entry.size * entry.count;
+        }
+        if (capacity_ != 0 && total != 0) {
+            std::size_t held = held_memory();
+            if (held > capacity_ || total > capacity_ - held) {
+                throw std::invalid_argument("Профиль превышает ёмкость пула");
+            }
+        }
+
+        // Сначала выделяем всё во временные корзины, затем переносим их в free-list
+        std::map<BlockKey, std::list<MemoryBlock>> staged;
+        try {
+            for (const auto& entry : profile) {
+                auto& bucket = staged[{entry.size, entry.alignment}];
+                for (std::size_t i = 0; i < entry.count; ++i) {
+                    // Узел списка создаётся до выделения памяти, чтобы блок не утёк
+                    bucket.push_back({nullptr, entry.size, entry.alignment});
+                    bucket.back().ptr = ::operator new(entry.size, std::align_val_t(entry.alignment));
+                }
+                if (verbose_) std::cout << "   Прогрев: " << entry.count << " блоков по " << entry.size << " байт" << std::endl;
+            }
+            for (auto& [key, bucket] : staged) {
+                auto& target = free_blocks[key];
+                target.splice(target.end(), bucket);
+            }
+        } catch (...) {
+            for (auto& [key, bucket] : staged) {
+                release(bucket);
+            }
+            throw;
+        }
+    }
+
+    // Снимок профиля: блоки с кучи не возвращаются до уничтожения ресурса,
+    // поэтому занятые и свободные блоки вместе дают пиковый набор размеров
+    std::vector<ProfileEntry> record_profile() const {
+        std::map<BlockKey, std::size_t> counts;
+        for (const auto& b : used_blocks) ++counts[{b.size, b.alignment}];
+        for (const auto& [key, bucket] : free_blocks) counts[key] += bucket.size();
+
+        std::vector<ProfileEntry> profile;
+        profile.reserve(counts.size());
+        for (const auto& [key, count] : counts) {
+            profile.push_back({key.first, key.second, count});
+        }
+        return profile;
+    }
+
+    // Текстовый формат профиля: по строке "size alignment count", '#' — комментарий
+    static void write_profile(std::ostream& out, const std::vector<ProfileEntry>& profile) {
+        out << "# size alignment count\n";
+        for (const auto& entry : profile) {
+            out << entry.size << ' ' << entry.alignment << ' ' << entry.count << '\n';
+        }
+    }
+
+    static std::vector<ProfileEntry> read_profile(std::istream& in) {
+        std::vector<ProfileEntry> profile;
+        std::string line;
+        while (std::getline(in, line)) {
+            std::string content = line.substr(0, line.find('#'));
+            std::istringstream fields(content);
+            std::vector<std::string> tokens;
+            for (std::string token; fields >> token;) {
+                tokens.push_back(token);
+            }
+            if (tokens.empty()) continue; // пустая строка или комментарий
+
+            ProfileEntry entry;
+            if (tokens.size() != 3 || !parse_count(tokens[0], entry.size) ||
+                !parse_count(tokens[1], entry.alignment) || !parse_count(tokens[2], entry.count) ||
+                !is_valid(entry)) {
+                throw std::invalid_argument("Некорректная строка профиля: " + line);
+            }
+            profile.push_back(entry);
+        }
+        return profile;
+    }
+
+private:
+    static bool is_valid(const ProfileEntry& entry) noexcept {
+        return entry.size != 0 && entry.alignment != 0 && (entry.alignment & (entry.alignment - 1)) == 0;
+    }
+
+    // Только десятичные цифры: знак "-" и прочий мусор отвергаются
+    static bool parse_count(const std::string& token, std::size_t& value) {
+        if (token.empty() || token.find_first_not_of("0123456789") != std::string::npos) {
+            return false;
+        }
+        try {
+            value = static_cast<std::size_t>(std::stoull(token));
+        } catch (const std::out_of_range&) {
+            return false;
+        }
+        return true;
+    }
+
+    // Байт во всех блоках, полученных с кучи: занятых и лежащих в free-list
+    std::size_t held_memory() const noexcept {
+        std::size_t held = 0;
+        for (const auto& b : used_blocks) held += b.size;
+        for (const auto& [key, bucket] : free_blocks) held += key.first * bucket.size();
+        return held;
+    }
+
+    static void release(std::list<MemoryBlock>& blocks) noexcept {
+        for (auto &b : blocks) {
+            if (b.ptr) {
+                ::operator delete(b.ptr, std::align_val_t(b.alignment));
+            }
+        }
+        blocks.clear();
+    }
+
 protected:
     void* do_allocate(std::size_t bytes, std::size_t alignment) override {
-        // Попытка найти подходящий блок в free-list (переиспользование)
-        for (auto it = free_blocks.begin(); it != free_blocks.end(); ++it) {
-            if (it->size >= bytes && it->alignment >= alignment) {
-                void* ptr = it->ptr;
-                // Переносим блок в used_blocks и корректируем статистику
-                used_blocks.push_back(*it);
-                used_memory_ += it->size;
-                free_blocks.erase(it);
-                if (verbose_) std::cout << "   Повторное использование: адрес " << ptr << ", размер " << bytes << " байт" << std::endl;
-                return ptr;
-            }
+        // Попытка найти подходящий блок в free-list (переиспользование):
+        // корзины упорядочены по размеру, начинаем с наименьшего подходящего.
+        // Поиск стоит O(log k + m), где k — число корзин (различных пар размер/выравнивание),
+        // а m — корзины, пропущенные из-за выравнивания; число блоков в корзине не влияет
+        for (auto it = free_blocks.lower_bound({bytes, alignment}); it != free_blocks.end(); ++it) {
+            if (it->first.second < alignment) continue;
+            auto& bucket = it->second;
+            const MemoryBlock& block = bucket.front();
+            // Переиспользованный блок тоже учитывается в ёмкости пула
+            if (capacity_ != 0 && used_memory_ + block.size > capacity_) break;
+
+            void* ptr = block.ptr;
+            // Переносим блок в used_blocks и корректируем статистику
+            used_blocks.push_back(block);
+            used_memory_ += block.size;
+            bucket.pop_front();
+            if (bucket.empty()) free_blocks.erase(it);
+            if (verbose_) std::cout << "   Повторное использование: адрес " << ptr << ", размер " << bytes << " байт" << std::endl;
+            return ptr;
         }
 
         // Проверяем, хватает ли свободного пространства в пуле
@@ -89,7 +241,7 @@ protected:
             if (it->ptr == ptr) {
                 // Переносим блок в free-list — оставляем блок для переиспользования
                 used_memory_ = (used_memory_ >= it->size) ? (used_memory_ - it->size) : 0;
-                free_blocks.push_back(*it);
+                free_blocks[{it->size, it->alignment}].push_back(*it);
                 used_blocks.erase(it);
                 return;
             }
@@ -61,6 +61,21 @@ int main() {
         employees.clear();
     }
 
+    std::cout << "\n--- Warm start test ---\n";
+    {
+        // Профиль снимается с уже поработавшего ресурса и прогревает новый
+        auto profile = mr.record_profile();
+        std::cout << "Recorded profile:\n";
+        CustomMemoryResource::write_profile(std::cout, profile);
+
+        CustomMemoryResource warm_mr;
+        warm_mr.warm_up(profile);
+        list<int> li3(&warm_mr);
+        li3.push_back(1);
+        li3.push_back(2);
+        std::cout << "Contents (from warm pool): "; li3.print_list();
+    }
+
     std::cout << "\nProgram finished. CustomMemoryResource will be destroyed and remaining memory cleaned up." << std::endl;
     return 0;
 }
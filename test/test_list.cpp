@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 #include "../include/list.h"
 #include "../include/memory_resource.h"
+#include <span>
+#include <vector>
 
 // Тест 1: Создание списка
 TEST(DoublyLinkedListTest, Construction) {
@@ -231,4 +233,65 @@ TEST(DoublyLinkedListTest, MemoryReuse) {
     
     // Память не должна сильно вырасти (переиспользование)
     EXPECT_LE(used_after_reuse, used_after_push + 100); // Небольшой запас на выравнивание
-}
\ No newline at end of file
+}
+
+// Тест 15: Итератор с предвыборкой проходит те же элементы
+TEST(DoublyLinkedListTest, PrefetchIterator) {
+    CustomMemoryResource mr;
+    list<int> list(&mr);
+
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+
+    int expected = 0;
+    for (auto it = list.prefetch_begin(); it != list.prefetch_end(); ++it) {
+        EXPECT_EQ(*it, expected);
+        ++expected;
+    }
+    EXPECT_EQ(expected, 10);
+
+    // Постфиксный инкремент
+    auto it = list.prefetch_begin();
+    EXPECT_EQ(*it++, 0);
+    EXPECT_EQ(*it, 1);
+    EXPECT_TRUE(list.prefetch_begin() != list.prefetch_end());
+}
+
+// Тест 16: Пакетный обход
+TEST(DoublyLinkedListTest, ForEachBatch) {
+    CustomMemoryResource mr;
+    list<int> list(&mr);
+
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+
+    std::vector<size_t> batch_sizes;
+    int expected = 0;
+    list.for_each_batch([&](std::span<int* const> batch) {
+        batch_sizes.push_back(batch.size());
+        for (int* value : batch) {
+            EXPECT_EQ(*value, expected);
+            *value *= 2; // Элементы доступны для изменения
+            ++expected;
+        }
+    }, 4);
+
+    EXPECT_EQ(batch_sizes, (std::vector<size_t>{4, 4, 2}));
+    EXPECT_EQ(*(++list.begin()), 2);
+}
+
+// Тест 17: Пакетный обход пустого списка и неверный размер пачки
+TEST(DoublyLinkedListTest, ForEachBatchEdgeCases) {
+    CustomMemoryResource mr;
+    list<int> list(&mr);
+
+    int calls = 0;
+    list.for_each_batch([&](std::span<int* const>) { ++calls; }, 4);
+    EXPECT_EQ(calls, 0);
+
+    EXPECT_THROW({
+        list.for_each_batch([](std::span<int* const>) {}, 0);
+    }, std::invalid_argument);
+}
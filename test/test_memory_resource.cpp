@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 #include "../include/memory_resource.h"
 #include <memory_resource>
+#include <sstream>
+#include <vector>
 
 // Тест 1: Создание memory_resource
 TEST(MemoryResourceTest, Construction) {
@@ -131,4 +133,150 @@ TEST(MemoryResourceTest, DifferentSizes) {
     EXPECT_NE(ptr_small, ptr_medium);
     EXPECT_NE(ptr_medium, ptr_large);
     EXPECT_NE(ptr_small, ptr_large);
-}
\ No newline at end of file
+}
+
+// Тест 11: Прогрев пула по профилю
+TEST(MemoryResourceTest, WarmUp) {
+    CustomMemoryResource mr(1024);
+    mr.warm_up({{64, alignof(int), 3}});
+
+    // Прогретые блоки не считаются занятыми
+    EXPECT_EQ(mr.get_used_memory(), 0);
+
+    std::vector<void*> pointers;
+    for (int i = 0; i < 3; ++i) {
+        pointers.push_back(mr.allocate(64, alignof(int)));
+    }
+    EXPECT_EQ(mr.get_used_memory(), 192);
+
+    // Новых блоков с кучи не появилось
+    std::vector<CustomMemoryResource::ProfileEntry> expected{{64, alignof(int), 3}};
+    EXPECT_EQ(mr.record_profile(), expected);
+
+    for (void* ptr : pointers) {
+        mr.deallocate(ptr, 64, alignof(int));
+    }
+
+    EXPECT_THROW({
+        mr.warm_up({{64, 3, 1}});
+    }, std::invalid_argument);
+}
+
+// Тест 12: Прогрев не обходит ёмкость пула
+TEST(MemoryResourceTest, WarmUpCapacity) {
+    CustomMemoryResource mr(1024);
+
+    EXPECT_THROW({
+        mr.warm_up({{64, alignof(int), 100}});
+    }, std::invalid_argument);
+    EXPECT_TRUE(mr.record_profile().empty());
+
+    // Ровно по ёмкости — допустимо, дальше пул не растёт
+    mr.warm_up({{64, alignof(int), 16}});
+    for (int i = 0; i < 16; ++i) {
+        (void)mr.allocate(64, alignof(int));
+    }
+    EXPECT_EQ(mr.get_used_memory(), 1024);
+    EXPECT_THROW({
+        (void)mr.allocate(64, alignof(int));
+    }, std::bad_alloc);
+
+    // Уже удерживаемые блоки тоже учитываются: повторный прогрев не проходит
+    EXPECT_THROW({
+        mr.warm_up({{64, alignof(int), 1}});
+    }, std::invalid_argument);
+}
+
+// Тест 13: Повторный прогрев учитывает блоки, уже лежащие в пуле
+TEST(MemoryResourceTest, WarmUpTwice) {
+    CustomMemoryResource mr(1024);
+    mr.warm_up({{64, 8, 8}});
+    mr.warm_up({{64, 8, 8}});
+
+    EXPECT_THROW({
+        mr.warm_up({{64, 8, 1}});
+    }, std::invalid_argument);
+
+    std::vector<CustomMemoryResource::ProfileEntry> expected{{64, 8, 16}};
+    EXPECT_EQ(mr.record_profile(), expected);
+}
+
+// Тест 14: Ошибочный профиль не меняет состояние ресурса
+TEST(MemoryResourceTest, WarmUpIsAtomic) {
+    CustomMemoryResource mr;
+
+    EXPECT_THROW({
+        mr.warm_up({{32, 8, 5}, {16, 3, 1}});
+    }, std::invalid_argument);
+    EXPECT_TRUE(mr.record_profile().empty());
+}
+
+// Тест 15: Из прогретого пула берётся наименьший подходящий блок
+TEST(MemoryResourceTest, WarmUpBestFit) {
+    CustomMemoryResource mr;
+    mr.warm_up({{256, 16, 2}, {24, 8, 1000}, {64, 16, 10}});
+
+    (void)mr.allocate(64, 16);
+    (void)mr.allocate(24, 8);
+    EXPECT_EQ(mr.get_used_memory(), 88);
+
+    // Блоки 256 байт не были тронуты и новых с кучи не появилось
+    std::vector<CustomMemoryResource::ProfileEntry> expected{{24, 8, 1000}, {64, 16, 10}, {256, 16, 2}};
+    EXPECT_EQ(mr.record_profile(), expected);
+}
+
+// Тест 16: Запись профиля из статистики и перенос в новый ресурс
+TEST(MemoryResourceTest, RecordProfile) {
+    CustomMemoryResource mr;
+    void* a = mr.allocate(32, alignof(double));
+    void* b = mr.allocate(32, alignof(double));
+    void* c = mr.allocate(128, alignof(std::max_align_t));
+    mr.deallocate(b, 32, alignof(double));
+
+    // Освобождённые блоки тоже входят в профиль: они остаются в пуле
+    std::vector<CustomMemoryResource::ProfileEntry> expected{
+        {32, alignof(double), 2},
+        {128, alignof(std::max_align_t), 1},
+    };
+    EXPECT_EQ(mr.record_profile(), expected);
+
+    CustomMemoryResource restarted;
+    restarted.warm_up(mr.record_profile());
+    EXPECT_EQ(restarted.record_profile(), expected);
+
+    mr.deallocate(a, 32, alignof(double));
+    mr.deallocate(c, 128, alignof(std::max_align_t));
+}
+
+// Тест 17: Сохранение и чтение профиля
+TEST(MemoryResourceTest, ProfileText) {
+    std::vector<CustomMemoryResource::ProfileEntry> profile{{24, 8, 1000}, {64, 16, 10}};
+
+    std::stringstream ss;
+    CustomMemoryResource::write_profile(ss, profile);
+    EXPECT_EQ(CustomMemoryResource::read_profile(ss), profile);
+
+    std::istringstream config("# узлы list<int>\n24 8 1000\n\n64 16 10  # хвостовой комментарий\n");
+    EXPECT_EQ(CustomMemoryResource::read_profile(config), profile);
+
+    std::istringstream broken("24 8\n");
+    EXPECT_THROW(CustomMemoryResource::read_profile(broken), std::invalid_argument);
+
+    std::istringstream extra("24 8 10 5\n");
+    EXPECT_THROW(CustomMemoryResource::read_profile(extra), std::invalid_argument);
+
+    for (const char* line : {"24 8 -1\n", "-24 8 1\n", "24 3 1\n", "0 8 1\n", "24 8 1x\n",
+                             "24 8 99999999999999999999999\n"}) {
+        std::istringstream bad(line);
+        EXPECT_THROW(CustomMemoryResource::read_profile(bad), std::invalid_argument) << line;
+    }
+
+    // В сообщении об ошибке есть сама строка
+    std::istringstream negative("24 8 -1\n");
+    try {
+        CustomMemoryResource::read_profile(negative);
+        FAIL();
+    } catch (const std::invalid_argument& e) {
+        EXPECT_NE(std::string(e.what()).find("24 8 -1"), std::string::npos);
+    }
+}